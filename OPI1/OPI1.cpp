@@ -3,6 +3,12 @@
 #include <sstream>
 #include <string>
 #include <iomanip> // Для setw, setprecision, fixed, left
+#include <vector>
+#include <unordered_map>
+#include <algorithm> // Для sort, unique
+#include <cctype>    // Для tolower
+#include <cstdint>
+#include <cmath>     // Для ceil
 
 using namespace std;
 
@@ -40,6 +46,27 @@ struct SpeciesReport {
     int totalAge = 0; ///< Сумарний вік тварин цього виду
 };
 
+/**
+ * @struct NameIndex
+ * @brief Інвертований триграмний індекс по іменах тварин для нечіткого пошуку.
+ */
+struct NameIndex {
+    unordered_map<uint32_t, vector<int>> postings; ///< Триграма -> позиції тварин у масиві
+    vector<int> trigramCounts;                     ///< Кількість унікальних триграм в імені кожної тварини
+    vector<string> paddedNames;                    ///< Імена в нижньому регістрі у вигляді "  name "
+    mutable vector<int> hits;                      ///< Лічильники збігів триграм для пошуку (між запитами нульові)
+};
+
+/**
+ * @struct NameMatch
+ * @brief Один результат пошуку тварини за ім'ям.
+ */
+struct NameMatch {
+    int pos = 0;            ///< Позиція тварини у масиві
+    double score = 0.0;     ///< Схожість імені із запитом (від 0 до 1)
+    bool substring = false; ///< Запит входить в ім'я як підрядок
+};
+
 // --- Константи ---
 const string USERS_FILE = "users.txt";     ///< Файл для зберігання даних користувачів
 const string ANIMALS_FILE = "animals.txt"; ///< Файл для зберігання даних тварин
@@ -48,6 +75,9 @@ const string REPORT_FILE = "report.txt";   ///< Файл для збережен
 const int MAX_USERS = 100;   ///< Максимальна кількість користувачів у системі
 const int MAX_ANIMALS = 500; ///< Максимальна кількість тварин у системі
 
+const int MAX_SEARCH_RESULTS = 10;       ///< Максимальна кількість результатів пошуку за ім'ям
+const double MIN_NAME_SIMILARITY = 0.3;  ///< Мінімальна схожість імені для нечіткого збігу
+
 // --- Допоміжні функції (Trim) ---
 
 static inline string ltrim(const string& s) {
@@ -369,11 +399,247 @@ void showAnimals(const Animal animals[], int count) {
     }
 }
 
+// --- Пошук тварин за ім'ям (триграмний індекс) ---
+
+static string toLowerAscii(const string& s) {
+    string result = s;
+    for (size_t i = 0; i < result.size(); ++i) {
+        result[i] = static_cast<char>(tolower(static_cast<unsigned char>(result[i])));
+    }
+    return result;
+}
+
+static string paddedName(const string& name) {
+    return "  " + toLowerAscii(trim(name)) + " ";
+}
+
+/**
+ * @brief Розбиває текст на відсортований набір унікальних триграм.
+ */
+static vector<uint32_t> textTrigrams(const string& text) {
+    vector<uint32_t> grams;
+    for (size_t i = 0; i + 3 <= text.size(); ++i) {
+        grams.push_back((static_cast<uint32_t>(static_cast<unsigned char>(text[i])) << 16) |
+            (static_cast<uint32_t>(static_cast<unsigned char>(text[i + 1])) << 8) |
+            static_cast<uint32_t>(static_cast<unsigned char>(text[i + 2])));
+    }
+    sort(grams.begin(), grams.end());
+    grams.erase(unique(grams.begin(), grams.end()), grams.end());
+    return grams;
+}
+
+/**
+ * @brief Триграми імені, доповненого пробілами ("  name "), щоб початок
+ * і кінець слова теж давали триграми і короткі імена мали що порівнювати.
+ */
+static vector<uint32_t> nameTrigrams(const string& name) {
+    return textTrigrams(paddedName(name));
+}
+
+/**
+ * @brief Порядок результатів: спершу підрядки, далі за спаданням схожості.
+ */
+static bool isBetterMatch(const NameMatch& a, const NameMatch& b) {
+    if (a.substring != b.substring) return a.substring;
+    if (a.score != b.score) return a.score > b.score;
+    return a.pos < b.pos;
+}
+
+/**
+ * @brief Зберігає лише maxResults найкращих збігів (купа з найгіршим на вершині),
+ * щоб не сортувати всі збіги, коли під запит підходить більшість імен.
+ */
+static void keepBestMatch(vector<NameMatch>& best, const NameMatch& m, int maxResults) {
+    if (static_cast<int>(best.size()) < maxResults) {
+        best.push_back(m);
+        push_heap(best.begin(), best.end(), isBetterMatch);
+    }
+    else if (isBetterMatch(m, best.front())) {
+        pop_heap(best.begin(), best.end(), isBetterMatch);
+        best.back() = m;
+        push_heap(best.begin(), best.end(), isBetterMatch);
+    }
+}
+
+/**
+ * @brief Додає ім'я тварини на позиції pos до індексу.
+ */
+void indexAnimalName(NameIndex& index, const Animal animals[], int pos) {
+    string padded = paddedName(animals[pos].name);
+    vector<uint32_t> grams = textTrigrams(padded);
+    if (static_cast<int>(index.trigramCounts.size()) <= pos) {
+        index.trigramCounts.resize(pos + 1, 0);
+        index.paddedNames.resize(pos + 1);
+        index.hits.resize(pos + 1, 0);
+    }
+    index.trigramCounts[pos] = static_cast<int>(grams.size());
+    index.paddedNames[pos].swap(padded);
+    for (size_t i = 0; i < grams.size(); ++i) {
+        index.postings[grams[i]].push_back(pos);
+    }
+}
+
+void buildNameIndex(NameIndex& index, const Animal animals[], int count) {
+    index.postings.clear();
+    index.trigramCounts.assign(count, 0);
+    index.paddedNames.assign(count, string());
+    index.hits.assign(count, 0);
+    for (int i = 0; i < count; ++i) {
+        indexAnimalName(index, animals, i);
+    }
+}
+
+/**
+ * @brief Шукає тварин за ім'ям: підрядок або схоже ім'я (з одруківками).
+ * Кандидати беруться зі списків індексу для триграм запиту, тож повний
+ * перегляд масиву потрібен лише для запитів коротших за 3 символи.
+ * Схожість — частка спільних триграм (коефіцієнт Жаккара).
+ * @return Кількість записаних у results збігів (не більше maxResults).
+ */
+int searchAnimalsByName(const NameIndex& index, int count,
+    const string& query, NameMatch results[], int maxResults) {
+    string q = toLowerAscii(trim(query));
+    if (q.empty() || maxResults <= 0) return 0;
+
+    vector<uint32_t> queryGrams = nameTrigrams(q);
+    int queryCount = static_cast<int>(queryGrams.size());
+    vector<NameMatch> matches;
+
+    if (q.size() < 3) {
+        // Внутрішніх триграм немає, тому підрядок у середині імені індекс не знайде
+        string gramText[3];
+        for (int i = 0; i < queryCount; ++i) {
+            gramText[i] = string(1, static_cast<char>(queryGrams[i] >> 16)) +
+                static_cast<char>((queryGrams[i] >> 8) & 0xFF) +
+                static_cast<char>(queryGrams[i] & 0xFF);
+        }
+
+        for (int pos = 0; pos < count; ++pos) {
+            const string& name = index.paddedNames[pos];
+            NameMatch m;
+            m.pos = pos;
+            m.substring = name.find(q) != string::npos;
+            // Схожість не перевищує q / n, тож довгі імена без підрядка відкидаються одразу
+            if (!m.substring && queryCount < MIN_NAME_SIMILARITY * index.trigramCounts[pos]) continue;
+
+            int shared = 0;
+            for (int i = 0; i < queryCount; ++i) {
+                if (name.find(gramText[i]) != string::npos) shared++;
+            }
+            m.score = static_cast<double>(shared) / (queryCount + index.trigramCounts[pos] - shared);
+            if (m.substring || m.score >= MIN_NAME_SIMILARITY) keepBestMatch(matches, m, maxResults);
+        }
+    }
+    else {
+        // Збіги внутрішніх триграм (без пробілів-доповнень) рахуються
+        // у старших 16 бітах лічильника, усі збіги — у молодших
+        const int INNER_HIT = 1 << 16;
+        vector<uint32_t> innerGrams = textTrigrams(q);
+        int innerCount = static_cast<int>(innerGrams.size());
+        if (queryCount >= INNER_HIT / 2) return 0;
+
+        vector<int>& hits = index.hits;
+        vector<int> candidates;
+        for (size_t i = 0; i < queryGrams.size(); ++i) {
+            unordered_map<uint32_t, vector<int>>::const_iterator it = index.postings.find(queryGrams[i]);
+            if (it == index.postings.end()) continue;
+            int step = binary_search(innerGrams.begin(), innerGrams.end(), queryGrams[i]) ? INNER_HIT + 1 : 1;
+            const vector<int>& list = it->second;
+            for (size_t k = 0; k < list.size(); ++k) {
+                int pos = list[k];
+                if (pos >= count) continue;
+                if (hits[pos] == 0) candidates.push_back(pos);
+                hits[pos] += step;
+            }
+        }
+
+        // Підрядок мусить містити всі внутрішні триграми запиту, а схожість
+        // h / (q + n - h) >= t можлива лише при h >= t * (q + n) / (1 + t)
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            int pos = candidates[i];
+            int shared = hits[pos] & (INNER_HIT - 1);
+            int nameCount = index.trigramCounts[pos];
+            int minShared = static_cast<int>(ceil(MIN_NAME_SIMILARITY * (queryCount + nameCount) /
+                (1.0 + MIN_NAME_SIMILARITY) - 1e-9));
+            bool maybeSubstring = hits[pos] / INNER_HIT >= innerCount;
+            if (!maybeSubstring && shared < minShared) continue;
+
+            NameMatch m;
+            m.pos = pos;
+            m.score = static_cast<double>(shared) / (queryCount + nameCount - shared);
+            m.substring = maybeSubstring && index.paddedNames[pos].find(q) != string::npos;
+            if (m.substring || m.score >= MIN_NAME_SIMILARITY) keepBestMatch(matches, m, maxResults);
+        }
+
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            hits[candidates[i]] = 0;
+        }
+    }
+
+    sort(matches.begin(), matches.end(), isBetterMatch);
+
+    int found = min(static_cast<int>(matches.size()), maxResults);
+    for (int i = 0; i < found; ++i) {
+        results[i] = matches[i];
+    }
+    return found;
+}
+
+void searchAnimals(const NameIndex& index, const Animal animals[], int count) {
+    cout << "\n=== Search Animals by Name ===\n";
+    if (count == 0) {
+        cout << "No animals found.\n";
+        return;
+    }
+
+    string query;
+    cout << "Enter name (or part of it): ";
+    getline(cin, query);
+    query = trim(query);
+    if (query.empty()) {
+        cout << "Error: Search query cannot be empty.\n";
+        return;
+    }
+
+    NameMatch results[MAX_SEARCH_RESULTS];
+    int found = searchAnimalsByName(index, count, query, results, MAX_SEARCH_RESULTS);
+    if (found == 0) {
+        cout << "No animals match \"" << query << "\".\n";
+        return;
+    }
+
+    cout << left << setw(5) << "ID"
+        << setw(20) << "Name"
+        << setw(20) << "Species"
+        << setw(7) << "Age"
+        << setw(10) << "Match"
+        << "Health Status" << "\n";
+    cout << string(80, '-') << "\n";
+
+    for (int i = 0; i < found; ++i) {
+        const Animal& a = animals[results[i].pos];
+        ostringstream match;
+        if (results[i].substring) {
+            match << "substring";
+        }
+        else {
+            match << fixed << setprecision(0) << results[i].score * 100 << "%";
+        }
+
+        cout << left << setw(5) << a.id
+            << setw(20) << a.name
+            << setw(20) << a.species
+            << setw(7) << a.age
+            << setw(10) << match.str()
+            << a.healthStatus << "\n";
+    }
+}
+
 // =================================================================================
 // МОДУЛЬ 2: ДОДАВАННЯ НОВОЇ ТВАРИНИ
 // =================================================================================
 
-void addNewAnimal(Animal animals[], int& count) {
+void addNewAnimal(Animal animals[], int& count, NameIndex& nameIndex) {
     if (count >= MAX_ANIMALS) {
         cout << "Error: Animal limit reached. Cannot add new animal.\n";
         return;
@@ -420,6 +686,7 @@ void addNewAnimal(Animal animals[], int& count) {
     getline(cin, a.healthStatus);
 
     animals[count] = a;
+    indexAnimalName(nameIndex, animals, count);
     count++;
 
     saveAnimals(animals, count);
@@ -430,24 +697,30 @@ void runAddAnimalModule() {
     Animal animals[MAX_ANIMALS];
     int animalCount = 0;
     loadAnimals(animals, animalCount);
+    NameIndex nameIndex;
+    buildNameIndex(nameIndex, animals, animalCount);
 
     cout << "\n=== Zoo Management System ===\n";
     cout << "=== Add New Animal Module ===\n\n";
     while (true) {
         cout << "1. Add new animal\n";
         cout << "2. Show all animals\n";
-        cout << "3. Exit to Main Menu\n";
+        cout << "3. Search animals by name\n";
+        cout << "4. Exit to Main Menu\n";
         cout << "Select option: ";
         string choice;
         getline(cin, choice);
 
         if (choice == "1") {
-            addNewAnimal(animals, animalCount);
+            addNewAnimal(animals, animalCount, nameIndex);
         }
         else if (choice == "2") {
             showAnimals(animals, animalCount);
         }
         else if (choice == "3") {
+            searchAnimals(nameIndex, animals, animalCount);
+        }
+        else if (choice == "4") {
             cout << "Returning to main menu...\n";
             break;
         }
@@ -509,6 +782,8 @@ void runUpdateAnimalModule() {
     Animal animals[MAX_ANIMALS];
     int animalCount = 0;
     loadAnimals(animals, animalCount);
+    NameIndex nameIndex;
+    buildNameIndex(nameIndex, animals, animalCount);
 
     cout << "\n=== Zoo Management System ===\n";
     cout << "=== Update Animal Information ===\n\n";
@@ -521,7 +796,8 @@ void runUpdateAnimalModule() {
     while (true) {
         cout << "\n1. Update animal info\n";
         cout << "2. Show all animals\n";
-        cout << "3. Exit to Main Menu\n";
+        cout << "3. Search animals by name\n";
+        cout << "4. Exit to Main Menu\n";
         cout << "Select option: ";
         string choice;
         getline(cin, choice);
@@ -533,6 +809,9 @@ void runUpdateAnimalModule() {
             showAnimals(animals, animalCount);
         }
         else if (choice == "3") {
+            searchAnimals(nameIndex, animals, animalCount);
+        }
+        else if (choice == "4") {
             cout << "Returning to main menu...\n";
             break;
         }